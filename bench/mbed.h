@@ -0,0 +1,47 @@
+/*
+*
+*   Minimal host stand-in for mbed.h, enough to build the library for bench/
+*
+*/
+
+#ifndef SSD1306_BENCH_MBED_H
+#define SSD1306_BENCH_MBED_H
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+typedef int PinName;
+
+// Counts the bytes written instead of driving a bus
+class I2C
+{
+public:
+	I2C(PinName sda, PinName scl) : bytes(0) {}
+	void frequency(int hz) {}
+	void start() {}
+	void stop() {}
+	int write(int data) { bytes++; return 1; }
+	int write(int address, const char* data, int length, bool repeated = false) { bytes += length + 1; return 0; }
+
+	long bytes; // Bytes written since construction, address bytes included
+};
+
+class Timer
+{
+public:
+	void start() { begin = std::chrono::steady_clock::now(); }
+	std::chrono::microseconds elapsed_time() {
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+	}
+
+private:
+	std::chrono::steady_clock::time_point begin;
+};
+
+inline void wait_us(int us) {}
+
+#endif
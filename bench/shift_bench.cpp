@@ -0,0 +1,104 @@
+/*
+*
+*   Host benchmark of SSD1306::shift() against a per-pixel getPixelState()/printPixel() baseline
+*
+*   g++ -O2 -funsigned-char -Ibench -Isrc bench/shift_bench.cpp src/SSD1306.cpp src/shiftSSD1306.cpp src/spriteSSD1306.cpp -o shift_bench
+*
+*/
+
+#include "mbed.h"
+#include "SSD1306.h"
+
+class BenchDisplay : public SSD1306
+{
+public:
+	BenchDisplay(I2C& bus) : SSD1306(bus) {}
+	char* buffer() { return displayBuffer; }
+};
+
+// Baseline: copy the region pixel by pixel
+static void shiftPerPixel(BenchDisplay& display, int dx, int dy, int x, int y, int width, int height) {
+	static bool source[128][64];
+
+	if (x + width > 128) width = 128 - x;
+	if (y + height > 64) height = 64 - y;
+
+	for (int i = x; i < x + width; i++)
+		for (int j = y; j < y + height; j++)
+			source[i][j] = display.getPixelState(i, j);
+
+	for (int i = x; i < x + width; i++)
+		for (int j = y; j < y + height; j++) {
+			int fromX = i - dx, fromY = j - dy;
+			bool on = fromX >= x && fromX < x + width && fromY >= y && fromY < y + height && source[fromX][fromY];
+			display.printPixel(i, j, on ? SSD1306::Normal : SSD1306::Inverse);
+		}
+}
+
+static void fillRandom(BenchDisplay& a, BenchDisplay& b) {
+	for (int i = 0; i < 1024; i++)
+		a.buffer()[i] = b.buffer()[i] = rand();
+}
+
+static double timeShift(BenchDisplay& display, int dx, int dy, int x, int y, int width, int height, int runs, bool perPixel) {
+	Timer timer;
+
+	timer.start();
+	for (int i = 0; i < runs; i++) {
+		if (perPixel)
+			shiftPerPixel(display, dx, dy, x, y, width, height);
+		else
+			display.shift(dx, dy, x, y, width, height);
+	}
+	return (double)timer.elapsed_time().count() / runs;
+}
+
+int main() {
+	I2C bus(0, 0);
+	BenchDisplay fast(bus), reference(bus);
+	const int checks = 20000;
+
+	srand(1);
+	for (int i = 0; i < checks; i++) {
+		int x = rand() % 128, y = rand() % 64, width = 1 + rand() % 128, height = 1 + rand() % 64;
+		int dx = rand() % 80 - 40, dy = rand() % 80 - 40;
+
+		if (rand() % 4 == 0) {
+			x = 0;
+			y = 0;
+			width = 128;
+			height = 64;
+		}
+		if (rand() % 3 == 0)
+			dx = 0;
+		else if (rand() % 3 == 0)
+			dy = 0;
+
+		fillRandom(fast, reference);
+		fast.shift(dx, dy, x, y, width, height);
+		shiftPerPixel(reference, dx, dy, x, y, width, height);
+		if (memcmp(fast.buffer(), reference.buffer(), 1024)) {
+			printf("FAIL: shift(%d, %d, %d, %d, %d, %d) differs from the per-pixel reference\n", dx, dy, x, y, width, height);
+			return 1;
+		}
+	}
+	printf("check: %d random regions match the per-pixel reference\n", checks);
+
+	static const struct { const char* name; int dx, dy, x, y, width, height; } cases[] = {
+		{ "full screen, dy=1", 0, 1, 0, 0, 128, 64 },
+		{ "full screen, dy=-37", 0, -37, 0, 0, 128, 64 },
+		{ "full screen, dx=1", 1, 0, 0, 0, 128, 64 },
+		{ "full screen, dx=-3 dy=5", -3, 5, 0, 0, 128, 64 },
+		{ "40x20 at (30,13), dx=1 dy=1", 1, 1, 30, 13, 40, 20 },
+	};
+	const int runs = 2000;
+
+	printf("%-30s %12s %12s %8s\n", "case", "shift() us", "per-pixel us", "speedup");
+	for (unsigned i = 0; i < sizeof cases / sizeof cases[0]; i++) {
+		fillRandom(fast, reference);
+		double shifted = timeShift(fast, cases[i].dx, cases[i].dy, cases[i].x, cases[i].y, cases[i].width, cases[i].height, runs, false);
+		double perPixel = timeShift(reference, cases[i].dx, cases[i].dy, cases[i].x, cases[i].y, cases[i].width, cases[i].height, runs, true);
+		printf("%-30s %12.2f %12.2f %7.1fx\n", cases[i].name, shifted, perPixel, shifted > 0 ? perPixel / shifted : 0);
+	}
+	return 0;
+}
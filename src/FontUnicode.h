@@ -0,0 +1,268 @@
+// Generated by ssd1306_font_subset.py: 255 glyphs, 2550 bytes
+
+#ifndef FONTUNICODE_H
+#define FONTUNICODE_H
+
+#include "SSD1306.h"
+
+static const SSD1306Glyph fontUnicodeGlyphs[255] = {
+    { 0x0020, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // U+0020
+    { 0x0021, { 0x00, 0x00, 0x06, 0x5F, 0x5F, 0x06, 0x00, 0x00 } }, // !
+    { 0x0022, { 0x00, 0x03, 0x07, 0x00, 0x00, 0x07, 0x03, 0x00 } }, // "
+    { 0x0023, { 0x14, 0x7F, 0x7F, 0x14, 0x7F, 0x7F, 0x14, 0x00 } }, // #
+    { 0x0024, { 0x00, 0x24, 0x2E, 0x6B, 0x6B, 0x3A, 0x12, 0x00 } }, // $
+    { 0x0025, { 0x46, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x62, 0x00 } }, // %
+    { 0x0026, { 0x30, 0x7A, 0x4F, 0x5D, 0x37, 0x7A, 0x48, 0x00 } }, // &
+    { 0x0027, { 0x00, 0x00, 0x04, 0x07, 0x03, 0x00, 0x00, 0x00 } }, // '
+    { 0x0028, { 0x00, 0x00, 0x1C, 0x3E, 0x63, 0x41, 0x00, 0x00 } }, // (
+    { 0x0029, { 0x00, 0x00, 0x41, 0x63, 0x3E, 0x1C, 0x00, 0x00 } }, // )
+    { 0x002A, { 0x08, 0x2A, 0x3E, 0x1C, 0x1C, 0x3E, 0x2A, 0x08 } }, // *
+    { 0x002B, { 0x00, 0x08, 0x08, 0x3E, 0x3E, 0x08, 0x08, 0x00 } }, // +
+    { 0x002C, { 0x00, 0x00, 0x80, 0xE0, 0x60, 0x00, 0x00, 0x00 } }, // ,
+    { 0x002D, { 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00 } }, // -
+    { 0x002E, { 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00 } }, // .
+    { 0x002F, { 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00 } }, // /
+    { 0x0030, { 0x1C, 0x3E, 0x63, 0x49, 0x63, 0x3E, 0x1C, 0x00 } }, // 0
+    { 0x0031, { 0x00, 0x40, 0x42, 0x7F, 0x7F, 0x40, 0x40, 0x00 } }, // 1
+    { 0x0032, { 0x42, 0x63, 0x71, 0x59, 0x49, 0x6F, 0x66, 0x00 } }, // 2
+    { 0x0033, { 0x22, 0x63, 0x49, 0x49, 0x49, 0x7F, 0x36, 0x00 } }, // 3
+    { 0x0034, { 0x18, 0x1C, 0x16, 0x53, 0x7F, 0x7F, 0x50, 0x00 } }, // 4
+    { 0x0035, { 0x2F, 0x6F, 0x49, 0x49, 0x49, 0x79, 0x31, 0x00 } }, // 5
+    { 0x0036, { 0x3C, 0x7E, 0x4B, 0x49, 0x49, 0x78, 0x30, 0x00 } }, // 6
+    { 0x0037, { 0x03, 0x03, 0x71, 0x79, 0x0D, 0x07, 0x03, 0x00 } }, // 7
+    { 0x0038, { 0x36, 0x7F, 0x49, 0x49, 0x49, 0x7F, 0x36, 0x00 } }, // 8
+    { 0x0039, { 0x06, 0x4F, 0x49, 0x49, 0x69, 0x3F, 0x1E, 0x00 } }, // 9
+    { 0x003A, { 0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00 } }, // :
+    { 0x003B, { 0x00, 0x00, 0x80, 0xE6, 0x66, 0x00, 0x00, 0x00 } }, // ;
+    { 0x003C, { 0x00, 0x00, 0x08, 0x1C, 0x36, 0x63, 0x41, 0x00 } }, // <
+    { 0x003D, { 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00 } }, // =
+    { 0x003E, { 0x00, 0x41, 0x63, 0x36, 0x1C, 0x08, 0x00, 0x00 } }, // >
+    { 0x003F, { 0x02, 0x03, 0x01, 0x59, 0x5D, 0x07, 0x02, 0x00 } }, // ?
+    { 0x0040, { 0x3E, 0x7F, 0x41, 0x5D, 0x5D, 0x1F, 0x1E, 0x00 } }, // @
+    { 0x0041, { 0x7C, 0x7E, 0x0B, 0x09, 0x0B, 0x7E, 0x7C, 0x00 } }, // A
+    { 0x0042, { 0x41, 0x7F, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x00 } }, // B
+    { 0x0043, { 0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x22, 0x00 } }, // C
+    { 0x0044, { 0x41, 0x7F, 0x7F, 0x41, 0x63, 0x3E, 0x1C, 0x00 } }, // D
+    { 0x0045, { 0x41, 0x7F, 0x7F, 0x49, 0x5D, 0x41, 0x63, 0x00 } }, // E
+    { 0x0046, { 0x41, 0x7F, 0x7F, 0x49, 0x1D, 0x01, 0x03, 0x00 } }, // F
+    { 0x0047, { 0x1C, 0x3E, 0x63, 0x41, 0x51, 0x33, 0x72, 0x00 } }, // G
+    { 0x0048, { 0x7F, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x7F, 0x00 } }, // H
+    { 0x0049, { 0x00, 0x00, 0x41, 0x7F, 0x7F, 0x41, 0x00, 0x00 } }, // I
+    { 0x004A, { 0x30, 0x70, 0x40, 0x41, 0x7F, 0x3F, 0x01, 0x00 } }, // J
+    { 0x004B, { 0x41, 0x7F, 0x7F, 0x08, 0x1C, 0x77, 0x63, 0x00 } }, // K
+    { 0x004C, { 0x41, 0x7F, 0x7F, 0x41, 0x40, 0x60, 0x70, 0x00 } }, // L
+    { 0x004D, { 0x7F, 0x7F, 0x0E, 0x1C, 0x0E, 0x7F, 0x7F, 0x00 } }, // M
+    { 0x004E, { 0x7F, 0x7F, 0x06, 0x0C, 0x18, 0x7F, 0x7F, 0x00 } }, // N
+    { 0x004F, { 0x3E, 0x7F, 0x41, 0x41, 0x41, 0x7F, 0x3E, 0x00 } }, // O
+    { 0x0050, { 0x41, 0x7F, 0x7F, 0x49, 0x09, 0x0F, 0x06, 0x00 } }, // P
+    { 0x0051, { 0x3E, 0x7F, 0x41, 0x41, 0xE1, 0xFF, 0xBE, 0x00 } }, // Q
+    { 0x0052, { 0x41, 0x7F, 0x7F, 0x09, 0x19, 0x7F, 0x66, 0x00 } }, // R
+    { 0x0053, { 0x00, 0x22, 0x67, 0x4D, 0x59, 0x73, 0x22, 0x00 } }, // S
+    { 0x0054, { 0x00, 0x07, 0x43, 0x7F, 0x7F, 0x43, 0x07, 0x00 } }, // T
+    { 0x0055, { 0x3F, 0x7F, 0x40, 0x40, 0x40, 0x7F, 0x3F, 0x00 } }, // U
+    { 0x0056, { 0x1F, 0x3F, 0x60, 0x40, 0x60, 0x3F, 0x1F, 0x00 } }, // V
+    { 0x0057, { 0x3F, 0x7F, 0x60, 0x38, 0x60, 0x7F, 0x3F, 0x00 } }, // W
+    { 0x0058, { 0x63, 0x77, 0x1C, 0x08, 0x1C, 0x77, 0x63, 0x00 } }, // X
+    { 0x0059, { 0x00, 0x07, 0x4F, 0x78, 0x78, 0x4F, 0x07, 0x00 } }, // Y
+    { 0x005A, { 0x47, 0x63, 0x71, 0x59, 0x4D, 0x67, 0x73, 0x00 } }, // Z
+    { 0x005B, { 0x00, 0x00, 0x7F, 0x7F, 0x41, 0x41, 0x00, 0x00 } }, // [
+    { 0x005C, { 0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x00 } }, // U+005C
+    { 0x005D, { 0x00, 0x00, 0x41, 0x41, 0x7F, 0x7F, 0x00, 0x00 } }, // ]
+    { 0x005E, { 0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x08, 0x00 } }, // ^
+    { 0x005F, { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 } }, // _
+    { 0x0060, { 0x00, 0x00, 0x01, 0x03, 0x06, 0x04, 0x00, 0x00 } }, // `
+    { 0x0061, { 0x20, 0x74, 0x54, 0x54, 0x3C, 0x78, 0x40, 0x00 } }, // a
+    { 0x0062, { 0x41, 0x7F, 0x3F, 0x44, 0x44, 0x7C, 0x38, 0x00 } }, // b
+    { 0x0063, { 0x38, 0x7C, 0x44, 0x44, 0x44, 0x6C, 0x28, 0x00 } }, // c
+    { 0x0064, { 0x38, 0x7C, 0x44, 0x45, 0x3F, 0x7F, 0x40, 0x00 } }, // d
+    { 0x0065, { 0x38, 0x7C, 0x54, 0x54, 0x54, 0x5C, 0x18, 0x00 } }, // e
+    { 0x0066, { 0x48, 0x7E, 0x7F, 0x49, 0x09, 0x03, 0x02, 0x00 } }, // f
+    { 0x0067, { 0x98, 0xBC, 0xA4, 0xA4, 0xF8, 0x7C, 0x04, 0x00 } }, // g
+    { 0x0068, { 0x41, 0x7F, 0x7F, 0x08, 0x04, 0x7C, 0x78, 0x00 } }, // h
+    { 0x0069, { 0x00, 0x00, 0x44, 0x7D, 0x7D, 0x40, 0x00, 0x00 } }, // i
+    { 0x006A, { 0x00, 0x60, 0xE0, 0x80, 0x80, 0xFD, 0x7D, 0x00 } }, // j
+    { 0x006B, { 0x41, 0x7F, 0x7F, 0x10, 0x38, 0x6C, 0x44, 0x00 } }, // k
+    { 0x006C, { 0x00, 0x00, 0x41, 0x7F, 0x7F, 0x40, 0x00, 0x00 } }, // l
+    { 0x006D, { 0x7C, 0x7C, 0x0C, 0x78, 0x0C, 0x7C, 0x78, 0x00 } }, // m
+    { 0x006E, { 0x04, 0x7C, 0x78, 0x04, 0x04, 0x7C, 0x78, 0x00 } }, // n
+    { 0x006F, { 0x38, 0x7C, 0x44, 0x44, 0x44, 0x7C, 0x38, 0x00 } }, // o
+    { 0x0070, { 0x84, 0xFC, 0xF8, 0xA4, 0x24, 0x3C, 0x18, 0x00 } }, // p
+    { 0x0071, { 0x18, 0x3C, 0x24, 0xA4, 0xF8, 0xFC, 0x84, 0x00 } }, // q
+    { 0x0072, { 0x44, 0x7C, 0x78, 0x4C, 0x04, 0x0C, 0x08, 0x00 } }, // r
+    { 0x0073, { 0x48, 0x5C, 0x54, 0x54, 0x54, 0x74, 0x24, 0x00 } }, // s
+    { 0x0074, { 0x04, 0x04, 0x3F, 0x7F, 0x44, 0x64, 0x20, 0x00 } }, // t
+    { 0x0075, { 0x3C, 0x7C, 0x40, 0x40, 0x3C, 0x7C, 0x40, 0x00 } }, // u
+    { 0x0076, { 0x1C, 0x3C, 0x60, 0x40, 0x60, 0x3C, 0x1C, 0x00 } }, // v
+    { 0x0077, { 0x3C, 0x7C, 0x60, 0x38, 0x60, 0x7C, 0x3C, 0x00 } }, // w
+    { 0x0078, { 0x44, 0x6C, 0x38, 0x10, 0x38, 0x6C, 0x44, 0x00 } }, // x
+    { 0x0079, { 0x9C, 0xBC, 0xA0, 0xA0, 0xA0, 0xFC, 0x7C, 0x00 } }, // y
+    { 0x007A, { 0x00, 0x4C, 0x64, 0x74, 0x5C, 0x4C, 0x64, 0x00 } }, // z
+    { 0x007B, { 0x00, 0x08, 0x08, 0x3E, 0x77, 0x41, 0x41, 0x00 } }, // {
+    { 0x007C, { 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00 } }, // |
+    { 0x007D, { 0x00, 0x41, 0x41, 0x77, 0x3E, 0x08, 0x08, 0x00 } }, // }
+    { 0x007E, { 0x02, 0x03, 0x01, 0x03, 0x02, 0x03, 0x01, 0x00 } }, // ~
+    { 0x00A0, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, // U+00A0
+    { 0x00A1, { 0x00, 0x00, 0x30, 0x7D, 0x7D, 0x30, 0x00, 0x00 } }, // ¡
+    { 0x00A2, { 0x18, 0x3C, 0x24, 0xE7, 0xE7, 0x24, 0x24, 0x00 } }, // ¢
+    { 0x00A3, { 0x48, 0x7E, 0x7F, 0x49, 0x43, 0x66, 0x20, 0x00 } }, // £
+    { 0x00A5, { 0x00, 0x2B, 0x2F, 0xFC, 0xFC, 0x2F, 0x2B, 0x00 } }, // ¥
+    { 0x00A7, { 0x40, 0x9A, 0xBF, 0xA5, 0xA5, 0xFD, 0x59, 0x02 } }, // §
+    { 0x00AA, { 0x00, 0x26, 0x2F, 0x29, 0x2F, 0x2F, 0x28, 0x00 } }, // ª
+    { 0x00AB, { 0x08, 0x1C, 0x36, 0x22, 0x08, 0x1C, 0x36, 0x22 } }, // «
+    { 0x00AC, { 0x08, 0x08, 0x08, 0x08, 0x08, 0x38, 0x38, 0x00 } }, // ¬
+    { 0x00B0, { 0x00, 0x06, 0x0F, 0x09, 0x0F, 0x06, 0x00, 0x00 } }, // °
+    { 0x00B1, { 0x00, 0x44, 0x44, 0x5F, 0x5F, 0x44, 0x44, 0x00 } }, // ±
+    { 0x00B2, { 0x00, 0x11, 0x19, 0x1D, 0x17, 0x12, 0x00, 0x00 } }, // ²
+    { 0x00B5, { 0x80, 0xFC, 0x7C, 0x40, 0x40, 0x7C, 0x3C, 0x00 } }, // µ
+    { 0x00B6, { 0x06, 0x0F, 0x09, 0x7F, 0x7F, 0x01, 0x7F, 0x7F } }, // ¶
+    { 0x00B7, { 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00 } }, // ·
+    { 0x00BA, { 0x00, 0x26, 0x2F, 0x29, 0x2F, 0x26, 0x00, 0x00 } }, // º
+    { 0x00BB, { 0x22, 0x36, 0x1C, 0x08, 0x22, 0x36, 0x1C, 0x08 } }, // »
+    { 0x00BC, { 0x42, 0x6F, 0x3F, 0x58, 0x6C, 0xD6, 0xFB, 0x41 } }, // ¼
+    { 0x00BD, { 0x42, 0x6F, 0x3F, 0x18, 0xCC, 0xEE, 0xBB, 0x91 } }, // ½
+    { 0x00BF, { 0x00, 0x20, 0x70, 0x5D, 0x4D, 0x40, 0x60, 0x20 } }, // ¿
+    { 0x00C4, { 0x79, 0x7D, 0x16, 0x12, 0x16, 0x7D, 0x79, 0x00 } }, // Ä
+    { 0x00C5, { 0x78, 0x7E, 0x17, 0x15, 0x17, 0x7E, 0x78, 0x00 } }, // Å
+    { 0x00C6, { 0x7C, 0x7E, 0x0B, 0x09, 0x7F, 0x7F, 0x49, 0x00 } }, // Æ
+    { 0x00C7, { 0x1E, 0xBF, 0xA1, 0xA1, 0xE1, 0x73, 0x12, 0x00 } }, // Ç
+    { 0x00C9, { 0x7C, 0x7C, 0x56, 0x57, 0x55, 0x44, 0x44, 0x00 } }, // É
+    { 0x00D1, { 0x7A, 0x7B, 0x19, 0x33, 0x62, 0x7B, 0x79, 0x00 } }, // Ñ
+    { 0x00D6, { 0x19, 0x3D, 0x66, 0x42, 0x66, 0x3D, 0x19, 0x00 } }, // Ö
+    { 0x00DC, { 0x3D, 0x7D, 0x40, 0x40, 0x40, 0x7D, 0x3D, 0x00 } }, // Ü
+    { 0x00DF, { 0x7E, 0x7F, 0x01, 0x09, 0x5F, 0x76, 0x20, 0x00 } }, // ß
+    { 0x00E0, { 0x20, 0x74, 0x55, 0x57, 0x3E, 0x78, 0x40, 0x00 } }, // à
+    { 0x00E1, { 0x20, 0x74, 0x56, 0x57, 0x3D, 0x78, 0x40, 0x00 } }, // á
+    { 0x00E2, { 0x22, 0x75, 0x55, 0x55, 0x3D, 0x79, 0x42, 0x00 } }, // â
+    { 0x00E4, { 0x21, 0x75, 0x54, 0x54, 0x3C, 0x79, 0x41, 0x00 } }, // ä
+    { 0x00E5, { 0x20, 0x74, 0x57, 0x57, 0x3C, 0x78, 0x40, 0x00 } }, // å
+    { 0x00E6, { 0x20, 0x74, 0x54, 0x7C, 0x7C, 0x54, 0x54, 0x00 } }, // æ
+    { 0x00E7, { 0x18, 0x3C, 0xA4, 0xA4, 0xE4, 0x64, 0x24, 0x00 } }, // ç
+    { 0x00E8, { 0x38, 0x7C, 0x55, 0x57, 0x56, 0x5C, 0x18, 0x00 } }, // è
+    { 0x00E9, { 0x38, 0x7C, 0x54, 0x56, 0x57, 0x5D, 0x18, 0x00 } }, // é
+    { 0x00EA, { 0x3A, 0x7D, 0x55, 0x55, 0x55, 0x5D, 0x1A, 0x00 } }, // ê
+    { 0x00EB, { 0x39, 0x7D, 0x54, 0x54, 0x54, 0x5D, 0x19, 0x00 } }, // ë
+    { 0x00EC, { 0x00, 0x00, 0x49, 0x7B, 0x7A, 0x40, 0x00, 0x00 } }, // ì
+    { 0x00ED, { 0x00, 0x00, 0x48, 0x7A, 0x7B, 0x41, 0x00, 0x00 } }, // í
+    { 0x00EE, { 0x02, 0x01, 0x45, 0x7D, 0x7D, 0x41, 0x02, 0x00 } }, // î
+    { 0x00EF, { 0x00, 0x01, 0x45, 0x7C, 0x7C, 0x41, 0x01, 0x00 } }, // ï
+    { 0x00F1, { 0x0A, 0x7B, 0x71, 0x0B, 0x0A, 0x7B, 0x71, 0x00 } }, // ñ
+    { 0x00F2, { 0x38, 0x7C, 0x45, 0x47, 0x46, 0x7C, 0x38, 0x00 } }, // ò
+    { 0x00F3, { 0x38, 0x7C, 0x44, 0x46, 0x47, 0x7D, 0x38, 0x00 } }, // ó
+    { 0x00F4, { 0x3A, 0x7D, 0x45, 0x45, 0x45, 0x7D, 0x3A, 0x00 } }, // ô
+    { 0x00F6, { 0x39, 0x7D, 0x44, 0x44, 0x44, 0x7D, 0x39, 0x00 } }, // ö
+    { 0x00F7, { 0x00, 0x08, 0x08, 0x2A, 0x2A, 0x08, 0x08, 0x00 } }, // ÷
+    { 0x00F9, { 0x3C, 0x7D, 0x43, 0x42, 0x3C, 0x7C, 0x40, 0x00 } }, // ù
+    { 0x00FA, { 0x3C, 0x7C, 0x42, 0x43, 0x3D, 0x7C, 0x40, 0x00 } }, // ú
+    { 0x00FB, { 0x3A, 0x79, 0x41, 0x41, 0x39, 0x7A, 0x40, 0x00 } }, // û
+    { 0x00FC, { 0x3D, 0x7D, 0x40, 0x40, 0x3D, 0x7D, 0x40, 0x00 } }, // ü
+    { 0x00FF, { 0x9D, 0xBD, 0xA0, 0xA0, 0xA0, 0xFD, 0x7D, 0x00 } }, // ÿ
+    { 0x0192, { 0x20, 0x60, 0x48, 0x7E, 0x3F, 0x09, 0x03, 0x02 } }, // ƒ
+    { 0x0393, { 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00 } }, // Γ
+    { 0x0398, { 0x1C, 0x3E, 0x6B, 0x49, 0x6B, 0x3E, 0x1C, 0x00 } }, // Θ
+    { 0x03A3, { 0x63, 0x77, 0x5D, 0x49, 0x41, 0x63, 0x63, 0x00 } }, // Σ
+    { 0x03A6, { 0x00, 0x99, 0xBD, 0xE7, 0xE7, 0xBD, 0x99, 0x00 } }, // Φ
+    { 0x03A9, { 0x4C, 0x7E, 0x73, 0x01, 0x73, 0x7E, 0x4C, 0x00 } }, // Ω
+    { 0x03B1, { 0x38, 0x7C, 0x44, 0x6C, 0x38, 0x6C, 0x44, 0x00 } }, // α
+    { 0x03B4, { 0x00, 0x30, 0x78, 0x4A, 0x4F, 0x7D, 0x39, 0x00 } }, // δ
+    { 0x03B5, { 0x00, 0x1C, 0x3E, 0x6B, 0x49, 0x49, 0x49, 0x00 } }, // ε
+    { 0x03C0, { 0x04, 0x7C, 0x7C, 0x04, 0x7C, 0x7C, 0x04, 0x00 } }, // π
+    { 0x03C3, { 0x38, 0x7C, 0x44, 0x7C, 0x3C, 0x04, 0x04, 0x00 } }, // σ
+    { 0x03C4, { 0x04, 0x06, 0x02, 0x7E, 0x7C, 0x06, 0x02, 0x00 } }, // τ
+    { 0x03C6, { 0x98, 0xFC, 0x64, 0x3C, 0x3E, 0x27, 0x3D, 0x18 } }, // φ
+    { 0x2022, { 0x00, 0x00, 0x18, 0x3C, 0x3C, 0x18, 0x00, 0x00 } }, // •
+    { 0x203C, { 0x00, 0x5F, 0x5F, 0x00, 0x00, 0x5F, 0x5F, 0x00 } }, // ‼
+    { 0x207F, { 0x00, 0x01, 0x1F, 0x1E, 0x01, 0x1F, 0x1E, 0x00 } }, // ⁿ
+    { 0x20A7, { 0xFF, 0xFF, 0x09, 0x09, 0x2F, 0xF6, 0xF8, 0xA0 } }, // ₧
+    { 0x2190, { 0x08, 0x1C, 0x3E, 0x2A, 0x08, 0x08, 0x08, 0x00 } }, // ←
+    { 0x2191, { 0x00, 0x04, 0x06, 0x7F, 0x7F, 0x06, 0x04, 0x00 } }, // ↑
+    { 0x2192, { 0x08, 0x08, 0x08, 0x2A, 0x3E, 0x1C, 0x08, 0x00 } }, // →
+    { 0x2193, { 0x00, 0x10, 0x30, 0x7F, 0x7F, 0x30, 0x10, 0x00 } }, // ↓
+    { 0x2194, { 0x08, 0x1C, 0x3E, 0x08, 0x08, 0x3E, 0x1C, 0x08 } }, // ↔
+    { 0x2195, { 0x00, 0x24, 0x66, 0xFF, 0xFF, 0x66, 0x24, 0x00 } }, // ↕
+    { 0x21A8, { 0x80, 0x94, 0xB6, 0xFF, 0xFF, 0xB6, 0x94, 0x80 } }, // ↨
+    { 0x2219, { 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 } }, // ∙
+    { 0x221A, { 0x10, 0x30, 0x70, 0xC0, 0xFF, 0xFF, 0x01, 0x01 } }, // √
+    { 0x221E, { 0x18, 0x3C, 0x24, 0x3C, 0x3C, 0x24, 0x3C, 0x18 } }, // ∞
+    { 0x221F, { 0x3C, 0x3C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00 } }, // ∟
+    { 0x2229, { 0x7C, 0x7E, 0x02, 0x02, 0x02, 0x7E, 0x7C, 0x00 } }, // ∩
+    { 0x2248, { 0x24, 0x36, 0x12, 0x36, 0x24, 0x36, 0x12, 0x00 } }, // ≈
+    { 0x2261, { 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x00 } }, // ≡
+    { 0x2264, { 0x00, 0x40, 0x44, 0x4E, 0x5B, 0x51, 0x40, 0x00 } }, // ≤
+    { 0x2265, { 0x00, 0x40, 0x51, 0x5B, 0x4E, 0x44, 0x40, 0x00 } }, // ≥
+    { 0x2302, { 0x70, 0x78, 0x4C, 0x46, 0x4C, 0x78, 0x70, 0x00 } }, // ⌂
+    { 0x2310, { 0x38, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00 } }, // ⌐
+    { 0x2320, { 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x07, 0x06 } }, // ⌠
+    { 0x2321, { 0x60, 0xE0, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00 } }, // ⌡
+    { 0x2500, { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 } }, // ─
+    { 0x2502, { 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00 } }, // │
+    { 0x250C, { 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x10, 0x10, 0x10 } }, // ┌
+    { 0x2510, { 0x10, 0x10, 0x10, 0xF0, 0xF0, 0x00, 0x00, 0x00 } }, // ┐
+    { 0x2514, { 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x10, 0x10, 0x10 } }, // └
+    { 0x2518, { 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x00, 0x00, 0x00 } }, // ┘
+    { 0x251C, { 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x10, 0x10, 0x10 } }, // ├
+    { 0x2524, { 0x10, 0x10, 0x10, 0xFF, 0xFF, 0x00, 0x00, 0x00 } }, // ┤
+    { 0x252C, { 0x10, 0x10, 0x10, 0xF0, 0xF0, 0x10, 0x10, 0x10 } }, // ┬
+    { 0x2534, { 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10 } }, // ┴
+    { 0x253C, { 0x10, 0x10, 0x10, 0xFF, 0xFF, 0x10, 0x10, 0x10 } }, // ┼
+    { 0x2550, { 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14 } }, // ═
+    { 0x2551, { 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00 } }, // ║
+    { 0x2552, { 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x14, 0x14, 0x14 } }, // ╒
+    { 0x2553, { 0x00, 0x00, 0xF0, 0xF0, 0x10, 0xF0, 0xF0, 0x10 } }, // ╓
+    { 0x2554, { 0x00, 0x00, 0xFC, 0xFC, 0x04, 0xF4, 0xF4, 0x14 } }, // ╔
+    { 0x2555, { 0x14, 0x14, 0x14, 0xFC, 0xFC, 0x00, 0x00, 0x00 } }, // ╕
+    { 0x2556, { 0x10, 0x10, 0xF0, 0xF0, 0x10, 0xF0, 0xF0, 0x00 } }, // ╖
+    { 0x2557, { 0x14, 0x14, 0xF4, 0xF4, 0x04, 0xFC, 0xFC, 0x00 } }, // ╗
+    { 0x2558, { 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x14, 0x14, 0x14 } }, // ╘
+    { 0x2559, { 0x00, 0x00, 0x1F, 0x1F, 0x10, 0x1F, 0x1F, 0x10 } }, // ╙
+    { 0x255A, { 0x00, 0x00, 0x1F, 0x1F, 0x10, 0x17, 0x17, 0x14 } }, // ╚
+    { 0x255B, { 0x14, 0x14, 0x14, 0x1F, 0x1F, 0x00, 0x00, 0x00 } }, // ╛
+    { 0x255C, { 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x1F, 0x1F, 0x00 } }, // ╜
+    { 0x255D, { 0x14, 0x14, 0x17, 0x17, 0x10, 0x1F, 0x1F, 0x00 } }, // ╝
+    { 0x255E, { 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x14, 0x14, 0x14 } }, // ╞
+    { 0x255F, { 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x10 } }, // ╟
+    { 0x2560, { 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xF7, 0xF7, 0x14 } }, // ╠
+    { 0x2561, { 0x14, 0x14, 0x14, 0xFF, 0xFF, 0x00, 0x00, 0x00 } }, // ╡
+    { 0x2562, { 0x10, 0x10, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00 } }, // ╢
+    { 0x2563, { 0x14, 0x14, 0xF7, 0xF7, 0x00, 0xFF, 0xFF, 0x00 } }, // ╣
+    { 0x2564, { 0x14, 0x14, 0x14, 0xF4, 0xF4, 0x14, 0x14, 0x14 } }, // ╤
+    { 0x2565, { 0x10, 0x10, 0xF0, 0xF0, 0x10, 0xF0, 0xF0, 0x10 } }, // ╥
+    { 0x2566, { 0x14, 0x14, 0xF4, 0xF4, 0x04, 0xF4, 0xF4, 0x14 } }, // ╦
+    { 0x2567, { 0x14, 0x14, 0x14, 0x17, 0x17, 0x14, 0x14, 0x14 } }, // ╧
+    { 0x2568, { 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x1F, 0x1F, 0x10 } }, // ╨
+    { 0x2569, { 0x14, 0x14, 0x17, 0x17, 0x10, 0x17, 0x17, 0x14 } }, // ╩
+    { 0x256A, { 0x14, 0x14, 0x14, 0xFF, 0xFF, 0x14, 0x14, 0x14 } }, // ╪
+    { 0x256B, { 0x10, 0x10, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0x10 } }, // ╫
+    { 0x256C, { 0x14, 0x14, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0x14 } }, // ╬
+    { 0x2580, { 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F } }, // ▀
+    { 0x2584, { 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0 } }, // ▄
+    { 0x2588, { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF } }, // █
+    { 0x258C, { 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 } }, // ▌
+    { 0x2590, { 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF } }, // ▐
+    { 0x2591, { 0xAA, 0x00, 0x55, 0x00, 0xAA, 0x00, 0x55, 0x00 } }, // ░
+    { 0x2592, { 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55 } }, // ▒
+    { 0x2593, { 0xAA, 0xFF, 0x55, 0xFF, 0xAA, 0xFF, 0x55, 0xFF } }, // ▓
+    { 0x25A0, { 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00 } }, // ■
+    { 0x25AC, { 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x00 } }, // ▬
+    { 0x25B2, { 0x30, 0x38, 0x3C, 0x3E, 0x3E, 0x3C, 0x38, 0x30 } }, // ▲
+    { 0x25BA, { 0x7F, 0x3E, 0x3E, 0x1C, 0x1C, 0x08, 0x08, 0x00 } }, // ►
+    { 0x25BC, { 0x06, 0x0E, 0x1E, 0x3E, 0x3E, 0x1E, 0x0E, 0x06 } }, // ▼
+    { 0x25C4, { 0x08, 0x08, 0x1C, 0x1C, 0x3E, 0x3E, 0x7F, 0x00 } }, // ◄
+    { 0x25CB, { 0x00, 0x3C, 0x66, 0x42, 0x42, 0x66, 0x3C, 0x00 } }, // ○
+    { 0x25D8, { 0xFF, 0xFF, 0xE7, 0xC3, 0xC3, 0xE7, 0xFF, 0xFF } }, // ◘
+    { 0x25D9, { 0xFF, 0xC3, 0x99, 0xBD, 0xBD, 0x99, 0xC3, 0xFF } }, // ◙
+    { 0x263A, { 0x7E, 0x81, 0x95, 0xB1, 0xB1, 0x95, 0x81, 0x7E } }, // ☺
+    { 0x263B, { 0x7E, 0xFF, 0xEB, 0xCF, 0xCF, 0xEB, 0xFF, 0x7E } }, // ☻
+    { 0x263C, { 0x5A, 0x5A, 0x3C, 0xE7, 0xE7, 0x3C, 0x5A, 0x5A } }, // ☼
+    { 0x2640, { 0x00, 0x4E, 0x5F, 0xF1, 0xF1, 0x5F, 0x4E, 0x00 } }, // ♀
+    { 0x2642, { 0x70, 0xF8, 0x88, 0x88, 0xFD, 0x7F, 0x07, 0x0F } }, // ♂
+    { 0x2660, { 0x18, 0x3C, 0xBE, 0xFF, 0xBE, 0x3C, 0x18, 0x00 } }, // ♠
+    { 0x2663, { 0x38, 0x3A, 0x9F, 0xFF, 0x9F, 0x3A, 0x38, 0x00 } }, // ♣
+    { 0x2665, { 0x0E, 0x1F, 0x3F, 0x7E, 0x3F, 0x1F, 0x0E, 0x00 } }, // ♥
+    { 0x2666, { 0x08, 0x1C, 0x3E, 0x7F, 0x3E, 0x1C, 0x08, 0x00 } }, // ♦
+    { 0x266A, { 0xC0, 0xE0, 0xFF, 0x7F, 0x05, 0x05, 0x07, 0x07 } }, // ♪
+    { 0x266B, { 0xC0, 0xFF, 0x7F, 0x05, 0x05, 0x65, 0x7F, 0x3F } }  // ♫
+};
+
+static const SSD1306Font fontUnicode = { fontUnicodeGlyphs, 255, 0, 95 };
+
+#endif
@@ -8,12 +8,16 @@
 
 #include "SSD1306.h"
 #include "mbed.h"
+#ifndef SSD1306_NO_DEFAULT_FONT
 #include "Font.h"
+#endif
 #include "commands.h"
 
 
 SSD1306::SSD1306(PinName sda, PinName scl, char displayAddress) {
 	currentTextPosition = 0;
+	startLine = 0;
+	font = NULL;
 	displayBuffer = new char[1024];
 	if (!displayBuffer) {
 		printf("SSD1306: Framebuffer allocation failed!\r\n");
@@ -23,6 +27,7 @@ SSD1306::SSD1306(PinName sda, PinName scl, char displayAddress) {
 	_I2C = new I2C(sda, scl);
 	I2CAddress = displayAddress;
 	deleteI2C = false;
+	initSprites();
 #ifdef SSD1306_DEBUG
 	printf("SSD1306 debug: fb = 0x%08.8X\r\n", displayBuffer);
 #endif
@@ -31,6 +36,8 @@ SSD1306::SSD1306(PinName sda, PinName scl, char displayAddress) {
 SSD1306::SSD1306(I2C& busI2C, char displayAddress) {
 	_I2C = &busI2C;
 	currentTextPosition = 0;
+	startLine = 0;
+	font = NULL;
 	displayBuffer = new char[1024];
 	if (!displayBuffer) {
 		printf("SSD1306: Framebuffer allocation failed!\r\n");
@@ -38,6 +45,7 @@ SSD1306::SSD1306(I2C& busI2C, char displayAddress) {
 	}
 	displayAddress = displayAddress;
 	deleteI2C = true;
+	initSprites();
 }
 
 void SSD1306::setSpeed(speedMode spd) {
@@ -95,11 +103,8 @@ int SSD1306::init(void) {
 }
 
 void SSD1306::scroll(bool refresh) {
-	for (int i = 128; i < 1024; i++)
-		displayBuffer[i - 128] = displayBuffer[i];
-
-	for (int i = 896; i < 1024; i++)
-		displayBuffer[i] = 0;
+	memmove(displayBuffer, displayBuffer + 128, 896);
+	memset(displayBuffer + 896, 0, 128);
 
 	if (refresh)
 		refreshDisplay();
@@ -109,24 +114,110 @@ void SSD1306::setCursor(char row, char column) {
 	currentTextPosition = row * 128 + column * 8;
 }
 
-void SSD1306::printChar(char c, bool refresh) {
-	int idx;
-
-	idx = c * 8;
+void SSD1306::printBitmap(const unsigned char* bitmap, bool refresh) {
 	if (currentTextPosition == 1024) {
 		scroll(refresh);
 		currentTextPosition = 896;
 	}
 	for (int i = 0; i < 8; i++) {
-		displayBuffer[currentTextPosition] = charset[idx + i];
+		displayBuffer[currentTextPosition] = bitmap ? bitmap[i] : 0;
 		currentTextPosition++;
 	}
 	if (refresh)
 		refreshDisplay();
 }
 
+void SSD1306::printChar(char c, bool refresh) {
+	if (font) {
+		printCodepoint((unsigned char)c, refresh);
+		return;
+	}
+#ifndef SSD1306_NO_DEFAULT_FONT
+	printBitmap((const unsigned char*)&charset[(unsigned char)c * 8], refresh);
+#else
+	printBitmap(NULL, refresh);
+#endif
+}
+
+void SSD1306::setFont(const SSD1306Font* unicodeFont) {
+	font = unicodeFont;
+}
+
+const unsigned char* SSD1306::findGlyph(unsigned long codepoint) {
+	const SSD1306Glyph* glyphs = font->glyphs;
+	unsigned long offset = codepoint - glyphs[font->directStart].codepoint;
+	int low = 0, high = font->count - 1;
+
+	if (codepoint >= glyphs[font->directStart].codepoint && offset < font->directCount)
+		return glyphs[font->directStart + offset].bitmap;
+
+	while (low <= high) {
+		int middle = (low + high) / 2;
+		if (glyphs[middle].codepoint < codepoint)
+			low = middle + 1;
+		else if (glyphs[middle].codepoint > codepoint)
+			high = middle - 1;
+		else
+			return glyphs[middle].bitmap;
+	}
+	return NULL;
+}
+
+void SSD1306::printCodepoint(unsigned long codepoint, bool refresh) {
+	const unsigned char* bitmap = NULL;
+
+	if (font && font->count) {
+		bitmap = findGlyph(codepoint);
+		if (!bitmap)
+			bitmap = findGlyph('?');
+	}
+#ifndef SSD1306_NO_DEFAULT_FONT
+	else {
+		// CP437 and Unicode only agree on ASCII
+		bitmap = (const unsigned char*)&charset[(codepoint < 0x80 ? codepoint : '?') * 8];
+	}
+#endif
+	printBitmap(bitmap, refresh);
+}
+
 void SSD1306::printString(char* s, bool refresh) {
-	while (*s) printChar(*s++, refresh);
+	if (!font) {
+		while (*s) printChar(*s++, refresh);
+		return;
+	}
+
+	// UTF-8: invalid or truncated sequences are printed as U+FFFD
+	while (*s) {
+		unsigned char lead = *s++;
+		unsigned long codepoint;
+		int following;
+
+		if (lead < 0x80) {
+			codepoint = lead;
+			following = 0;
+		} else if ((lead & 0xE0) == 0xC0) {
+			codepoint = lead & 0x1F;
+			following = 1;
+		} else if ((lead & 0xF0) == 0xE0) {
+			codepoint = lead & 0x0F;
+			following = 2;
+		} else if ((lead & 0xF8) == 0xF0) {
+			codepoint = lead & 0x07;
+			following = 3;
+		} else {
+			codepoint = 0xFFFD;
+			following = 0;
+		}
+
+		while (following--) {
+			if ((*s & 0xC0) != 0x80) {
+				codepoint = 0xFFFD;
+				break;
+			}
+			codepoint = (codepoint << 6) | (*s++ & 0x3F);
+		}
+		printCodepoint(codepoint, refresh);
+	}
 }
 
 void SSD1306::printf(const char* fmt, ...) {
@@ -141,23 +232,64 @@ void SSD1306::printf(const char* fmt, ...) {
 }
 
 
-void SSD1306::refreshDisplay(void) {
+void SSD1306::setWindow(char pageStart, char pageEnd, char columnStart, char columnEnd) {
+	const char window[] = { SSD1306_IS_COMMAND,
+							SSD1306_COLUMNADDR, columnStart, columnEnd,
+							SSD1306_PAGEADDR, pageStart, pageEnd
+	};
+
+	_I2C->write(I2CAddress, window, sizeof window);
+}
 
-	sendCommand(0xb0);
-	sendCommand(SSD1306_SETLOWCOLUMN | 0x0);  // low col = 0
-	sendCommand(SSD1306_SETHIGHCOLUMN | 0x0);  // hi col = 0
-	sendCommand(SSD1306_SETSTARTLINE | 0x0); // line #0
+void SSD1306::sendWindow(char pageStart, char pageEnd, char columnStart, char columnEnd) {
+	setWindow(pageStart, pageEnd, columnStart, columnEnd);
 
+	beginData();
+	for (int page = pageStart; page <= pageEnd; page++)
+		for (int column = columnStart; column <= columnEnd; column++)
+			writeData(displayBuffer[page * 128 + column]);
+	endData();
+}
+
+void SSD1306::beginData() {
 	_I2C->start();
 	_I2C->write(I2CAddress);
-	_I2C->write(0x40);
+	_I2C->write(SSD1306_IS_DATA);
+}
 
-	for (int i = 0; i < 1024; i++)
-		_I2C->write(displayBuffer[i]);
+void SSD1306::writeData(char pixels) {
+	_I2C->write(pixels);
+}
 
+void SSD1306::endData() {
 	_I2C->stop();
 }
 
+void SSD1306::refreshDisplay(void) {
+
+	sendCommand(SSD1306_SETSTARTLINE | startLine);
+
+	compositeSprites();
+	sendWindow(0, 7, 0, 127);
+	restoreSprites();
+	clearDirty();
+}
+
+void SSD1306::refreshRegion(char pageStart, char pageEnd, char columnStart, char columnEnd) {
+	if (pageEnd > 7) pageEnd = 7;
+	if (columnEnd > 127) columnEnd = 127;
+	if (pageStart > pageEnd || columnStart > columnEnd)
+		return;
+
+	compositeSprites();
+	sendWindow(pageStart, pageEnd, columnStart, columnEnd);
+	restoreSprites();
+}
+
+
+void SSD1306::setColumnPixels(char page, char column, char pixels) {
+	displayBuffer[(page % 8) * 128 + column % 128] = pixels;
+}
 
 void SSD1306::setBrightness(char brightness) {
 	sendCommand(SSD1306_SETBRIGHTNESS);
@@ -11,6 +11,43 @@
 
 #include "mbed.h"
 
+#ifndef SSD1306_MAX_SPRITES
+#define SSD1306_MAX_SPRITES 4 // Number of sprites in the sprite pool
+#endif
+
+#ifndef SSD1306_SPRITE_MAX_WIDTH
+#define SSD1306_SPRITE_MAX_WIDTH 16 // Maximum sprite width in pixels
+#endif
+
+#ifndef SSD1306_SPRITE_MAX_HEIGHT
+#define SSD1306_SPRITE_MAX_HEIGHT 16 // Maximum sprite height in pixels
+#endif
+
+// Bytes saved under one sprite: an unaligned sprite spans one page more than its height
+#define SSD1306_SPRITE_SAVE_SIZE (((SSD1306_SPRITE_MAX_HEIGHT + 6) / 8 + 1) * SSD1306_SPRITE_MAX_WIDTH)
+
+/**
+ * Glyph of a Unicode font
+ */
+struct SSD1306Glyph
+{
+	unsigned short codepoint; // Unicode code point
+	unsigned char bitmap[8]; // One byte per column, least significant bit on top
+};
+
+/**
+ * Unicode font: glyphs sorted by code point.
+ * Glyphs from directStart to directStart + directCount - 1 have consecutive code points
+ * and are found without searching. Fonts are created by tools/ssd1306_font_subset.py
+ */
+struct SSD1306Font
+{
+	const SSD1306Glyph* glyphs;
+	unsigned short count; // Number of glyphs
+	unsigned short directStart; // First glyph of the consecutive code points
+	unsigned short directCount; // Number of consecutive code points
+};
+
 /**
  *  SSD1306
  *  Library enables interaction with SSD1306 (128x64) OLED display
@@ -119,6 +156,32 @@ public:
 	 */
 	void scroll(bool refresh = false);
 
+	/**
+	 * Shift a rectangular region of the display by any number of pixels.
+	 * Pixels shifted out of the region are lost, uncovered pixels are cleared.
+	 * The shift is always done in the display buffer, also for the full screen:
+	 * it never uses the hardware start line, see setStartLine() for a wrapping hardware scroll
+	 *
+	 * @param dx Horizontal shift in pixels, positive to the right
+	 * @param dy Vertical shift in pixels, positive down
+	 * @param x X Coordinate of the region (0-127)
+	 * @param y Y Coordinate of the region (0-63)
+	 * @param width Width of the region in pixels (1-128)
+	 * @param height Height of the region in pixels (1-64)
+	 * @param refresh (Optional) Refresh the region on the display
+	 */
+	void shift(int dx, int dy, char x = 0, char y = 0, char width = 128, char height = 64, bool refresh = false);
+
+	/**
+	 * Set the display start line.
+	 * Scrolls the whole screen vertically in hardware, wrapping around, without sending any data:
+	 * the top row of the display shows row "line" of the display buffer.
+	 * Drawing coordinates still refer to the display buffer
+	 *
+	 * @param line Display buffer row shown on top (0-63)
+	 */
+	void setStartLine(char line);
+
 	/**
 	 * Print a character
 	 *
@@ -128,6 +191,24 @@ public:
 	 */
 	void printChar(char _char, bool refresh = false);
 
+	/**
+	 * Select the font used to print text.
+	 * With a Unicode font, strings are decoded as UTF-8 and printChar() prints the
+	 * Latin-1 character of its code. Characters missing from the font are printed as '?'
+	 *
+	 * @param font Unicode font, NULL selects the built-in CP437 charset
+	 */
+	void setFont(const SSD1306Font* font);
+
+	/**
+	 * Print a Unicode character with the selected font.
+	 * Without a Unicode font only ASCII is printed, other characters are printed as '?'
+	 *
+	 * @param codepoint Unicode code point of the character
+	 * @param refresh (Optional) Refresh Display
+	 */
+	void printCodepoint(unsigned long codepoint, bool refresh = false);
+
 
 	/**
 	 * Print constant pointer string
@@ -150,6 +231,55 @@ public:
 	 */
 	void refreshDisplay(void);
 
+	/**
+	 * Refresh a rectangular region of the display.
+	 * Send only the selected pages and columns from memory to display
+	 *
+	 * @param pageStart First page (0-7)
+	 * @param pageEnd Last page (0-7)
+	 * @param columnStart First column (0-127)
+	 * @param columnEnd Last column (0-127)
+	 */
+	void refreshRegion(char pageStart, char pageEnd, char columnStart, char columnEnd);
+
+	/**
+	 * Set 8 vertical pixels of the display buffer.
+	 * The display is not refreshed
+	 *
+	 * @param page Page (0-7)
+	 * @param column Column (0-127)
+	 * @param pixels One bit per row, least significant bit on top
+	 */
+	void setColumnPixels(char page, char column, char pixels);
+
+	/**
+	 * Select the display RAM area written by the following data.
+	 * Used to send data directly to the display, bypassing the display buffer
+	 *
+	 * @param pageStart First page (0-7)
+	 * @param pageEnd Last page (0-7)
+	 * @param columnStart First column (0-127)
+	 * @param columnEnd Last column (0-127)
+	 */
+	void setWindow(char pageStart, char pageEnd, char columnStart, char columnEnd);
+
+	/**
+	 * Start a data transfer to the display RAM area selected by setWindow()
+	 */
+	void beginData();
+
+	/**
+	 * Send one byte of a data transfer started by beginData()
+	 *
+	 * @param pixels One column of a page, least significant bit on top
+	 */
+	void writeData(char pixels);
+
+	/**
+	 * End a data transfer started by beginData()
+	 */
+	void endData();
+
 	/**
 	 * Set display brightness
 	 *
@@ -194,6 +324,51 @@ public:
 	 */
 	void drawLine(char xStart, char yStart, char xEnd, char yEnd, printMode mode = Normal, bool refresh = false);
 
+	/**
+	 * Define a sprite of the sprite pool.
+	 * Sprites are composited onto the display buffer only while it is sent to the display,
+	 * so the background drawn with printPixel(), drawLine() or printf() is never modified.
+	 * Bitmap and mask use the display buffer layout: one byte per column, (height + 7) / 8 pages,
+	 * least significant bit on top.
+	 * Position and visibility of the slot are kept: moveSprite() and showSprite() may be called
+	 * before or after setSprite(), and a new sprite starts hidden at (0,0) only if they were never called.
+	 *
+	 * @param id Sprite slot (0 to SSD1306_MAX_SPRITES - 1)
+	 * @param bitmap Sprite image, NULL releases the slot
+	 * @param mask Opaque pixels of the sprite. NULL uses the bitmap as mask
+	 * @param width Width in pixels (1 to SSD1306_SPRITE_MAX_WIDTH)
+	 * @param height Height in pixels (1 to SSD1306_SPRITE_MAX_HEIGHT)
+	 * @param z Z-order, sprites with higher z are drawn on top
+	 * @param mode Normal copies the sprite, Inverse copies it inverted, Xor toggles the background
+	 * @return 0 on success, -1 if a parameter is out of range
+	 */
+	int setSprite(char id, const char* bitmap, const char* mask, char width, char height, char z = 0, printMode mode = Normal);
+
+	/**
+	 * Move a sprite.
+	 * Old and new bounding boxes are marked to be sent by refreshSprites()
+	 *
+	 * @param id Sprite slot
+	 * @param x X Coordinate of the top left corner (0-127)
+	 * @param y Y Coordinate of the top left corner (0-63)
+	 */
+	void moveSprite(char id, char x, char y);
+
+	/**
+	 * Show or hide a sprite
+	 *
+	 * @param id Sprite slot
+	 * @param visible true to show the sprite, false to hide it
+	 */
+	void showSprite(char id, bool visible = true);
+
+	/**
+	 * Refresh sprites.
+	 * Send to display only the areas changed by setSprite(), moveSprite() and showSprite()
+	 * since the last refresh
+	 */
+	void refreshSprites(void);
+
 	/**
 	 * Turn the whole display off.
 	 * Reset display configuration
@@ -242,14 +417,47 @@ private:
 	 */
 	void printString(char* String, bool refresh = false);
 
+	const SSD1306Font* font; // Selected Unicode font, NULL for the built-in charset
+
+	const unsigned char* findGlyph(unsigned long codepoint); // Returns the glyph bitmap, NULL if missing
+	void printBitmap(const unsigned char* bitmap, bool refresh); // Prints 8 columns at the cursor
+
+	struct Sprite
+	{
+		const char* bitmap; // Sprite image, NULL if the slot is free
+		const char* mask; // Opaque pixels, NULL if the bitmap is the mask
+		char width;
+		char height;
+		char x;
+		char y;
+		char z;
+		printMode mode;
+		bool visible;
+	};
+
+	Sprite sprites[SSD1306_MAX_SPRITES]; // Sprite pool
+	char spriteSaveUnder[SSD1306_MAX_SPRITES][SSD1306_SPRITE_SAVE_SIZE]; // Background under composited sprites
+	unsigned char spriteOrder[SSD1306_MAX_SPRITES]; // Composited sprites, bottom to top
+	int spriteCount; // Number of composited sprites
+	unsigned char dirtyStart[8]; // First column to send, per page
+	unsigned char dirtyEnd[8]; // Last column to send, per page
+
+	void initSprites(); // Empties the sprite pool
+	void markDirty(const Sprite& sprite); // Marks the sprite bounding box to be sent
+	void clearDirty(); // Marks every page as sent
+	void compositeSprites(); // Draws visible sprites onto the display buffer, saving the background
+	void restoreSprites(); // Restores the background saved by compositeSprites()
+
 protected:
 	I2C* _I2C; // I2C object
 	char I2CAddress; // I2C address of SSD1306 controller
 	char* displayBuffer; // pointer to display buffer (1024 bytes)
 	bool deleteI2C;
 	int currentTextPosition; // Current text position (referred to screen address memory)
+	char startLine; // Display buffer row shown on top of the display
 	int sendCommand(char c); // Sends a I2C command to SSD1306
 	int sendData(char d); // Sends I2C data to SSD1306  
+	void sendWindow(char pageStart, char pageEnd, char columnStart, char columnEnd); // Sends an area of the display buffer
 };
 
 #endif
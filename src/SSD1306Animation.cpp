@@ -0,0 +1,90 @@
+/*
+*
+*   SSD1306 animation player
+*
+*/
+
+#include "SSD1306Animation.h"
+#include "mbed.h"
+
+SSD1306Animation::SSD1306Animation(SSD1306& display, const unsigned char* data)
+	: _display(display) {
+	animation = data;
+	rewind();
+}
+
+int SSD1306Animation::getFrameCount() {
+	return animation[0] | (animation[1] << 8);
+}
+
+int SSD1306Animation::getFramePeriod() {
+	return animation[2] | (animation[3] << 8);
+}
+
+void SSD1306Animation::rewind() {
+	position = animation + 4;
+	frame = 0;
+}
+
+void SSD1306Animation::sendRuns(int length) {
+	_display.beginData();
+
+	while (length > 0) {
+		int control = *position++;
+
+		if (control >= SSD1306_ANIMATION_RUN) {
+			int count = control - SSD1306_ANIMATION_RUN + 1;
+			char pixels = *position++;
+			length -= count;
+			while (count--)
+				_display.writeData(pixels);
+		} else {
+			int count = control + 1;
+			length -= count;
+			while (count--)
+				_display.writeData(*position++);
+		}
+	}
+
+	_display.endData();
+}
+
+bool SSD1306Animation::nextFrame() {
+	if (frame >= getFrameCount())
+		return false;
+
+	if (*position++ == SSD1306_ANIMATION_KEYFRAME) {
+		_display.setWindow(0, 7, 0, 127);
+		sendRuns(1024);
+	} else {
+		while (*position != SSD1306_ANIMATION_END_SPANS) {
+			char page = position[0];
+			char column = position[1];
+			int length = position[2] + 1;
+			position += 3;
+
+			_display.setWindow(page, page, column, column + length - 1);
+			sendRuns(length);
+		}
+		position++;
+	}
+
+	frame++;
+	return true;
+}
+
+void SSD1306Animation::play(int loops) {
+	Timer timer;
+	long long next = 0;
+
+	timer.start();
+	while (loops-- > 0) {
+		rewind();
+		while (nextFrame()) {
+			next += getFramePeriod() * 1000LL;
+			long long now = timer.elapsed_time().count();
+			if (now < next)
+				wait_us(next - now);
+		}
+	}
+}
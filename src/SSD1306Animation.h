@@ -0,0 +1,109 @@
+/*
+*
+*   SSD1306 animation player
+*
+*/
+
+#ifndef SSD1306_ANIMATION_H
+#define SSD1306_ANIMATION_H
+
+#include "mbed.h"
+#include "SSD1306.h"
+
+/*
+ * Animation format, created by tools/ssd1306_anim_encode.py
+ *
+ * Header: frame count (2 bytes), frame period in ms (2 bytes), little endian
+ * Keyframe: SSD1306_ANIMATION_KEYFRAME, then 1024 bytes of display data packed as runs
+ * Delta frame: SSD1306_ANIMATION_DELTA, then the changed spans of the frame, each one:
+ *     page, first column, length - 1, then length bytes of display data packed as runs
+ *   and SSD1306_ANIMATION_END_SPANS after the last span
+ * Runs: control byte n, then
+ *     n < SSD1306_ANIMATION_RUN: n + 1 literal bytes
+ *     n >= SSD1306_ANIMATION_RUN: one byte repeated (n - SSD1306_ANIMATION_RUN) + 1 times
+ *
+ * The first frame is always a keyframe.
+ */
+#define SSD1306_ANIMATION_KEYFRAME	0x00
+#define SSD1306_ANIMATION_DELTA		0x01
+#define SSD1306_ANIMATION_END_SPANS	0xFF
+#define SSD1306_ANIMATION_RUN		0x80
+
+/**
+ *  SSD1306Animation
+ *  Plays compressed animations stored in flash.
+ *  Frames are decoded while they are sent to the display, only the changed spans of a frame
+ *  are sent and no frame buffer is needed. The display buffer of SSD1306 is not modified:
+ *  call refreshDisplay() to show it again after the animation.
+ *
+ * Example of use:
+ * @code
+	#include "mbed.h"
+	#include "SSD1306.h"
+	#include "SSD1306Animation.h"
+	#include "bootAnimation.h" // created by tools/ssd1306_anim_encode.py
+
+	SSD1306 display (D14, D15);
+
+	int main()
+	{
+		display.setSpeed(SSD1306::Medium);
+		display.init();
+
+		SSD1306Animation animation (display, bootAnimation);
+		animation.play();
+
+		display.clearScreen();
+	}
+ * @endcode
+ */
+class SSD1306Animation
+{
+public:
+	/**
+	 * Create an animation player
+	 *
+	 * @param display Display to play on
+	 * @param animation Encoded animation
+	 */
+	SSD1306Animation(SSD1306& display, const unsigned char* animation);
+
+	/**
+	 * Return the number of frames
+	 */
+	int getFrameCount();
+
+	/**
+	 * Return the frame period in milliseconds
+	 */
+	int getFramePeriod();
+
+	/**
+	 * Send the next frame to the display
+	 *
+	 * @return true if a frame was sent, false after the last frame
+	 */
+	bool nextFrame();
+
+	/**
+	 * Restart from the first frame
+	 */
+	void rewind();
+
+	/**
+	 * Play the animation, one frame per frame period
+	 *
+	 * @param loops (Optional) Number of times the animation is played
+	 */
+	void play(int loops = 1);
+
+private:
+	SSD1306& _display;
+	const unsigned char* animation; // Start of the encoded animation
+	const unsigned char* position; // Next byte to decode
+	int frame; // Next frame to send
+
+	void sendRuns(int length); // Decodes length bytes of runs straight to the display
+};
+
+#endif
@@ -0,0 +1,156 @@
+/*
+*
+*   SSD1306 strip chart
+*
+*/
+
+#include "SSD1306StripChart.h"
+#include "mbed.h"
+
+SSD1306StripChart::SSD1306StripChart(SSD1306& display, char x, char page, char columns, char height, chartMode chart)
+	: _display(display) {
+	left = x % 128;
+	pageStart = page % 8;
+	width = columns;
+	pages = height;
+	if (width < 1 || left + width > 128) width = 128 - left;
+	if (pages < 1 || pageStart + pages > 8) pages = 8 - pageStart;
+	mode = chart;
+
+	columnMin = new short[width];
+	columnMax = new short[width];
+	if (!columnMin || !columnMax) {
+		printf("SSD1306StripChart: Sample buffer allocation failed!\r\n");
+		while (true) {}
+	}
+
+	minValue = 0;
+	maxValue = pages * 8 - 1;
+	samplesPerColumn = 1;
+	setGap(0);
+	head = 0;
+	filled = 0;
+	bucketSamples = 0;
+	hasLastValue = false;
+}
+
+void SSD1306StripChart::setRange(short minimum, short maximum) {
+	minValue = minimum;
+	maxValue = maximum;
+}
+
+void SSD1306StripChart::setSamplesPerColumn(int samples) {
+	samplesPerColumn = samples < 1 ? 1 : samples;
+	bucketSamples = 0;
+}
+
+int SSD1306StripChart::valueToRow(short value) {
+	int rows = pages * 8;
+	int range = maxValue - minValue;
+	int row;
+
+	if (range == 0)
+		return rows - 1;
+	row = (maxValue - value) * (rows - 1) / range;
+	if (row < 0) row = 0;
+	if (row > rows - 1) row = rows - 1;
+	return row;
+}
+
+void SSD1306StripChart::drawColumn(int column, short low, short high) {
+	int top = valueToRow(high), bottom = valueToRow(low);
+
+	// With an inverted range the high value is on the lower row
+	if (top > bottom) {
+		int row = top;
+		top = bottom;
+		bottom = row;
+	}
+
+	for (int page = 0; page < pages; page++) {
+		int first = top - page * 8, last = bottom - page * 8;
+		unsigned char pixels = 0;
+
+		if (first < 0) first = 0;
+		if (last > 7) last = 7;
+		if (first <= last)
+			pixels = (0xFF << first) & (0xFF >> (7 - last));
+		_display.setColumnPixels(pageStart + page, column, pixels);
+	}
+}
+
+void SSD1306StripChart::clearColumn(int column) {
+	for (int page = 0; page < pages; page++)
+		_display.setColumnPixels(pageStart + page, column, 0);
+}
+
+void SSD1306StripChart::setGap(int columns) {
+	gap = columns < 0 ? 0 : columns;
+	if (gap > width - 1)
+		gap = width - 1;
+}
+
+void SSD1306StripChart::addSample(short value) {
+	if (bucketSamples == 0) {
+		// Start from the previous sample, so the trace has no gaps between columns
+		bucketMin = hasLastValue ? lastValue : value;
+		bucketMax = bucketMin;
+	}
+	if (value < bucketMin) bucketMin = value;
+	if (value > bucketMax) bucketMax = value;
+	if (++bucketSamples < samplesPerColumn)
+		return;
+
+	bucketSamples = 0;
+	lastValue = value;
+	hasLastValue = true;
+
+	columnMin[head] = bucketMin;
+	columnMax[head] = bucketMax;
+
+	if (mode == Sweep) {
+		// The new column and the gap ahead of it are sent together, split where the sweep wraps
+		int last = head + gap;
+		drawColumn(left + head, bucketMin, bucketMax);
+		for (int column = head + 1; column <= last; column++)
+			clearColumn(left + column % width);
+		_display.refreshRegion(pageStart, pageStart + pages - 1, left + head, left + (last < width ? last : width - 1));
+		if (last >= width)
+			_display.refreshRegion(pageStart, pageStart + pages - 1, left, left + last - width);
+	} else {
+		_display.shift(-1, 0, left, pageStart * 8, width, pages * 8);
+		drawColumn(left + width - 1, bucketMin, bucketMax);
+		_display.refreshRegion(pageStart, pageStart + pages - 1, left, left + width - 1);
+	}
+
+	head = (head + 1) % width;
+	if (filled < width)
+		filled++;
+}
+
+void SSD1306StripChart::redraw() {
+	for (int column = left; column < left + width; column++)
+		clearColumn(column);
+
+	for (int i = 0; i < filled; i++) {
+		if (mode == Sweep) {
+			// Oldest columns stay hidden behind the gap
+			if ((i - head + width) % width >= gap)
+				drawColumn(left + i, columnMin[i], columnMax[i]);
+		} else {
+			// Newest column on the right
+			int ring = (head - 1 - i + width) % width;
+			drawColumn(left + width - 1 - i, columnMin[ring], columnMax[ring]);
+		}
+	}
+
+	_display.refreshRegion(pageStart, pageStart + pages - 1, left, left + width - 1);
+}
+
+void SSD1306StripChart::clear() {
+	head = 0;
+	filled = 0;
+	bucketSamples = 0;
+	hasLastValue = false;
+	redraw();
+}
@@ -0,0 +1,150 @@
+/*
+*
+*   SSD1306 strip chart
+*
+*/
+
+#ifndef SSD1306_STRIPCHART_H
+#define SSD1306_STRIPCHART_H
+
+#include "mbed.h"
+#include "SSD1306.h"
+
+/**
+ *  SSD1306StripChart
+ *  Scrolling plot of live values on a SSD1306 display.
+ *  Every new column is drawn as a single vertical span. In Sweep mode a new column costs one
+ *  column write on the bus (8 bytes for a full height chart), plus one per column of the optional
+ *  gap set with setGap(). In Scroll mode the whole chart is sent for every new column,
+ *  up to 1024 bytes: use it only for slow signals or small charts.
+ *
+ * Example of use:
+ * @code
+	#include "mbed.h"
+	#include "SSD1306.h"
+	#include "SSD1306StripChart.h"
+
+	SSD1306 display (D14, D15);
+	AnalogIn sensor (A0);
+
+	int main()
+	{
+		display.setSpeed(SSD1306::Medium);
+		display.init();
+		display.clearScreen();
+
+		SSD1306StripChart chart (display, 0, 2, 128, 6);
+		chart.setRange(0, 1000);
+		chart.setSamplesPerColumn(4);
+
+		while (true) {
+			chart.addSample(sensor.read() * 1000);
+			wait_us (5000);
+		}
+	}
+ * @endcode
+ */
+class SSD1306StripChart
+{
+public:
+	/**
+	 * Select how the chart advances
+	 *
+	 * @param Sweep New columns overwrite the oldest ones from left to right, like a monitor trace
+	 * @param Scroll The chart moves left and new columns enter on the right
+	 */
+	enum chartMode
+	{
+		Sweep,	/*!< The new column, and the gap ahead of it if any, are sent per new column >*/
+		Scroll	/*!< The whole chart is sent per new column: up to 1024 bytes on the bus >*/
+	};
+
+	/**
+	 * Create a strip chart on a region of the display
+	 *
+	 * @param display Display to draw on
+	 * @param x X Coordinate of the left column (0-127)
+	 * @param pageStart First page of the chart (0-7)
+	 * @param width Width in columns (1-128)
+	 * @param pages Height in pages (1-8)
+	 * @param mode Sweep or Scroll, otherwise Sweep
+	 */
+	SSD1306StripChart(SSD1306& display, char x = 0, char pageStart = 0, char width = 128, char pages = 8, chartMode mode = Sweep);
+
+	/**
+	 * Set the values shown at the bottom and at the top of the chart.
+	 * minValue may be greater than maxValue to plot an inverted axis
+	 *
+	 * @param minValue Value at the bottom row
+	 * @param maxValue Value at the top row
+	 */
+	void setRange(short minValue, short maxValue);
+
+	/**
+	 * Set how many samples are merged into one column.
+	 * A column shows the min/max envelope of its samples
+	 *
+	 * @param samples Samples per column (1 or more)
+	 */
+	void setSamplesPerColumn(int samples);
+
+	/**
+	 * Set the blank gap cleared ahead of the newest column in Sweep mode.
+	 * It separates the newest column from the oldest data, each gap column costs
+	 * one more column write on the bus per new column
+	 *
+	 * @param columns Gap width in columns (0 to width - 1), otherwise 0
+	 */
+	void setGap(int columns);
+
+	/**
+	 * Add a sample.
+	 * When a column is complete it is drawn and sent to the display
+	 *
+	 * @param value Sample value
+	 */
+	void addSample(short value);
+
+	/**
+	 * Draw every stored column again and send the chart to the display
+	 */
+	void redraw();
+
+	/**
+	 * Clear the chart and its stored samples
+	 */
+	void clear();
+
+	virtual ~SSD1306StripChart()
+	{
+		delete[] columnMin;
+		delete[] columnMax;
+	}
+
+private:
+	SSD1306& _display;
+	char left; // Left column of the chart
+	char pageStart; // First page of the chart
+	char width; // Width in columns
+	char pages; // Height in pages
+	chartMode mode;
+	short minValue; // Value at the bottom row
+	short maxValue; // Value at the top row
+	short* columnMin; // Ring of column envelopes, lowest value
+	short* columnMax; // Ring of column envelopes, highest value
+	int head; // Ring position of the next column
+	int filled; // Number of stored columns
+	int samplesPerColumn;
+	int gap; // Blank columns ahead of the newest column in Sweep mode
+	int bucketSamples; // Samples in the current column
+	short bucketMin; // Envelope of the current column
+	short bucketMax;
+	short lastValue; // Last sample of the previous column, joins neighbouring columns
+	bool hasLastValue;
+
+	int valueToRow(short value); // Chart row of a value, 0 is the top row
+	void drawColumn(int column, short low, short high); // Draws an envelope in a screen column
+	void clearColumn(int column); // Clears a screen column
+};
+
+#endif
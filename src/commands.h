@@ -12,6 +12,8 @@
 #define SSD1306_COMSCANDEC			0xC8
 #define SSD1306_SEGREMAP			0xA0
 #define SSD1306_CHARGEPUMP			0x8D
+#define SSD1306_COLUMNADDR			0x21
+#define SSD1306_PAGEADDR			0x22
 
 //#define SSD1306_EXTERNALVCC					0x1
 //#define SSD1306_SWITCHCAPVCC					0x2
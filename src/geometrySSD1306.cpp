@@ -8,7 +8,6 @@
 
 #include "SSD1306.h"
 #include "mbed.h"
-#include "Font.h"
 
 void SSD1306::drawLine (char xStart, char yStart, char xEnd, char yEnd, printMode mode, bool refresh){
     int dx =  abs (xEnd - xStart), sx = xStart < xEnd ? 1 : -1;
@@ -0,0 +1,114 @@
+/*
+*
+*   SSD1306 framebuffer shift
+*
+*/
+
+#include "SSD1306.h"
+#include "mbed.h"
+#include "commands.h"
+
+// Rows first to last - 1 of one 32 row half of a column, rows relative to the half
+static uint32_t halfMask(int first, int last) {
+	if (first < 0) first = 0;
+	if (last > 32) last = 32;
+	if (first >= last)
+		return 0;
+	return (last - first == 32 ? 0xFFFFFFFFu : (1u << (last - first)) - 1) << first;
+}
+
+void SSD1306::shift(int dx, int dy, char x, char y, char width, char height, bool refresh) {
+	int left = (unsigned char)x, top = (unsigned char)y;
+	int columns = (unsigned char)width, rows = (unsigned char)height;
+
+	if (left > 127 || top > 63 || columns == 0 || rows == 0)
+		return;
+	if (left + columns > 128) columns = 128 - left;
+	if (top + rows > 64) rows = 64 - top;
+
+	int right = left + columns - 1;
+	int pageStart = top / 8, pageEnd = (top + rows - 1) / 8;
+	uint32_t maskLow = halfMask(top, top + rows); // Region rows 0-31
+	uint32_t maskHigh = halfMask(top - 32, top + rows - 32); // Region rows 32-63
+
+	// Vertical: every column is handled as two 32 bit words (pages 0-3 and 4-7),
+	// bits carry between pages inside a word and from one word to the other
+	if (dy) {
+		int distance = dy > 0 ? dy : -dy;
+
+		for (int column = left; column <= right; column++) {
+			uint32_t low = 0, high = 0;
+
+			for (int page = pageStart; page <= pageEnd; page++) {
+				uint32_t pixels = (unsigned char)displayBuffer[page * 128 + column];
+				if (page < 4)
+					low |= pixels << (page * 8);
+				else
+					high |= pixels << ((page - 4) * 8);
+			}
+
+			uint32_t movedLow = low & maskLow, movedHigh = high & maskHigh;
+			if (distance >= rows) {
+				movedLow = 0;
+				movedHigh = 0;
+			} else if (distance >= 32) {
+				if (dy > 0) {
+					movedHigh = movedLow << (distance - 32);
+					movedLow = 0;
+				} else {
+					movedLow = movedHigh >> (distance - 32);
+					movedHigh = 0;
+				}
+			} else if (dy > 0) {
+				movedHigh = (movedHigh << distance) | (movedLow >> (32 - distance));
+				movedLow <<= distance;
+			} else {
+				movedLow = (movedLow >> distance) | (movedHigh << (32 - distance));
+				movedHigh >>= distance;
+			}
+			low = (low & ~maskLow) | (movedLow & maskLow);
+			high = (high & ~maskHigh) | (movedHigh & maskHigh);
+
+			for (int page = pageStart; page <= pageEnd; page++)
+				displayBuffer[page * 128 + column] = page < 4 ? low >> (page * 8) : high >> ((page - 4) * 8);
+		}
+	}
+
+	// Horizontal: whole pages are moved with memmove, partially covered pages are blended
+	if (dx) {
+		for (int page = pageStart; page <= pageEnd; page++) {
+			char* line = displayBuffer + page * 128;
+			unsigned char mask = page < 4 ? maskLow >> (page * 8) : maskHigh >> ((page - 4) * 8);
+
+			if (mask == 0xFF) {
+				if (dx >= columns || -dx >= columns) {
+					memset(line + left, 0, columns);
+				} else if (dx > 0) {
+					memmove(line + left + dx, line + left, columns - dx);
+					memset(line + left, 0, dx);
+				} else {
+					memmove(line + left, line + left - dx, columns + dx);
+					memset(line + right + 1 + dx, 0, -dx);
+				}
+			} else if (dx > 0) {
+				for (int column = right; column >= left; column--) {
+					unsigned char pixels = column - dx >= left ? line[column - dx] : 0;
+					line[column] = (line[column] & ~mask) | (pixels & mask);
+				}
+			} else {
+				for (int column = left; column <= right; column++) {
+					unsigned char pixels = column - dx <= right ? line[column - dx] : 0;
+					line[column] = (line[column] & ~mask) | (pixels & mask);
+				}
+			}
+		}
+	}
+
+	if (refresh)
+		refreshRegion(pageStart, pageEnd, left, right);
+}
+
+void SSD1306::setStartLine(char line) {
+	startLine = line % 64;
+	sendCommand(SSD1306_SETSTARTLINE | startLine);
+}
@@ -0,0 +1,185 @@
+/*
+*
+*   SSD1306 sprite pool
+*
+*/
+
+#include "SSD1306.h"
+#include "mbed.h"
+
+static void blendByte(char* target, unsigned char bits, unsigned char mask, SSD1306::printMode mode) {
+	unsigned char pixels = *target;
+
+	switch (mode) {
+	case SSD1306::Normal:
+		pixels = (pixels & ~mask) | (bits & mask);
+		break;
+	case SSD1306::Inverse:
+		pixels = (pixels & ~mask) | (~bits & mask);
+		break;
+	case SSD1306::Xor:
+		pixels ^= bits & mask;
+		break;
+	}
+	*target = pixels;
+}
+
+void SSD1306::initSprites() {
+	for (int i = 0; i < SSD1306_MAX_SPRITES; i++) {
+		sprites[i].bitmap = NULL;
+		sprites[i].x = 0;
+		sprites[i].y = 0;
+		sprites[i].visible = false;
+	}
+	spriteCount = 0;
+	clearDirty();
+}
+
+void SSD1306::clearDirty() {
+	for (int page = 0; page < 8; page++) {
+		dirtyStart[page] = 128; // Start after end: nothing to send
+		dirtyEnd[page] = 0;
+	}
+}
+
+void SSD1306::markDirty(const Sprite& sprite) {
+	unsigned char x = sprite.x, y = sprite.y;
+
+	if (!sprite.bitmap || !sprite.visible || x > 127 || y > 63)
+		return;
+
+	int columnEnd = x + sprite.width - 1;
+	int pageEnd = (y + sprite.height - 1) / 8;
+	if (columnEnd > 127) columnEnd = 127;
+	if (pageEnd > 7) pageEnd = 7;
+
+	for (int page = y / 8; page <= pageEnd; page++) {
+		if (x < dirtyStart[page]) dirtyStart[page] = x;
+		if (columnEnd > dirtyEnd[page]) dirtyEnd[page] = columnEnd;
+	}
+}
+
+int SSD1306::setSprite(char id, const char* bitmap, const char* mask, char width, char height, char z, printMode mode) {
+	if ((unsigned char)id >= SSD1306_MAX_SPRITES)
+		return -1;
+	if (bitmap && (width < 1 || width > SSD1306_SPRITE_MAX_WIDTH || height < 1 || height > SSD1306_SPRITE_MAX_HEIGHT))
+		return -1;
+
+	Sprite& sprite = sprites[(unsigned char)id];
+
+	markDirty(sprite);
+	sprite.bitmap = bitmap;
+	sprite.mask = mask;
+	sprite.width = width;
+	sprite.height = height;
+	sprite.z = z;
+	sprite.mode = mode;
+	markDirty(sprite);
+	return 0;
+}
+
+void SSD1306::moveSprite(char id, char x, char y) {
+	if ((unsigned char)id >= SSD1306_MAX_SPRITES)
+		return;
+
+	Sprite& sprite = sprites[(unsigned char)id];
+
+	if (sprite.x == x && sprite.y == y)
+		return;
+	markDirty(sprite);
+	sprite.x = x;
+	sprite.y = y;
+	markDirty(sprite);
+}
+
+void SSD1306::showSprite(char id, bool visible) {
+	if ((unsigned char)id >= SSD1306_MAX_SPRITES)
+		return;
+
+	Sprite& sprite = sprites[(unsigned char)id];
+
+	if (sprite.visible == visible)
+		return;
+	markDirty(sprite);
+	sprite.visible = visible;
+	markDirty(sprite);
+}
+
+void SSD1306::compositeSprites() {
+	spriteCount = 0;
+
+	// Insertion sort by z, sprites with the same z keep their slot order
+	for (int i = 0; i < SSD1306_MAX_SPRITES; i++) {
+		const Sprite& sprite = sprites[i];
+		if (!sprite.bitmap || !sprite.visible || (unsigned char)sprite.x > 127 || (unsigned char)sprite.y > 63)
+			continue;
+
+		int position = spriteCount++;
+		while (position > 0 && sprites[spriteOrder[position - 1]].z > sprite.z) {
+			spriteOrder[position] = spriteOrder[position - 1];
+			position--;
+		}
+		spriteOrder[position] = i;
+	}
+
+	for (int i = 0; i < spriteCount; i++) {
+		const Sprite& sprite = sprites[spriteOrder[i]];
+		char* saveUnder = spriteSaveUnder[spriteOrder[i]];
+		unsigned char x = sprite.x, y = sprite.y;
+		int shift = y % 8;
+		int sourcePages = (sprite.height + 7) / 8;
+		int columns = sprite.width;
+		int pageEnd = (y + sprite.height - 1) / 8;
+		if (x + columns > 128) columns = 128 - x;
+		if (pageEnd > 7) pageEnd = 7;
+
+		for (int page = y / 8; page <= pageEnd; page++)
+			for (int column = 0; column < columns; column++)
+				*saveUnder++ = displayBuffer[page * 128 + x + column];
+
+		for (int sourcePage = 0; sourcePage < sourcePages; sourcePage++) {
+			int page = y / 8 + sourcePage;
+			unsigned char lastRows = 0xFF;
+			if (sourcePage == sourcePages - 1 && sprite.height % 8)
+				lastRows = (1 << (sprite.height % 8)) - 1;
+
+			for (int column = 0; column < columns; column++) {
+				unsigned char bits = sprite.bitmap[sourcePage * sprite.width + column];
+				unsigned char mask = sprite.mask ? sprite.mask[sourcePage * sprite.width + column] : bits;
+				mask &= lastRows;
+
+				if (page <= 7)
+					blendByte(&displayBuffer[page * 128 + x + column], bits << shift, mask << shift, sprite.mode);
+				if (shift && page + 1 <= 7)
+					blendByte(&displayBuffer[(page + 1) * 128 + x + column], bits >> (8 - shift), mask >> (8 - shift), sprite.mode);
+			}
+		}
+	}
+}
+
+void SSD1306::restoreSprites() {
+	// Top to bottom, so overlapping sprites give back the original background
+	while (spriteCount > 0) {
+		spriteCount--;
+		const Sprite& sprite = sprites[spriteOrder[spriteCount]];
+		const char* saveUnder = spriteSaveUnder[spriteOrder[spriteCount]];
+		unsigned char x = sprite.x, y = sprite.y;
+		int columns = sprite.width;
+		int pageEnd = (y + sprite.height - 1) / 8;
+		if (x + columns > 128) columns = 128 - x;
+		if (pageEnd > 7) pageEnd = 7;
+
+		for (int page = y / 8; page <= pageEnd; page++)
+			for (int column = 0; column < columns; column++)
+				displayBuffer[page * 128 + x + column] = *saveUnder++;
+	}
+}
+
+void SSD1306::refreshSprites(void) {
+	compositeSprites();
+	for (int page = 0; page < 8; page++)
+		if (dirtyStart[page] <= dirtyEnd[page])
+			sendWindow(page, page, dirtyStart[page], dirtyEnd[page]);
+	restoreSprites();
+	clearDirty();
+}
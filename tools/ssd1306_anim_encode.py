@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+#
+#   Encoder for SSD1306Animation
+#
+#   Converts 128x64 PBM images (one per frame, in order) into a C header with the
+#   animation format described in src/SSD1306Animation.h.
+#
+#   Example:
+#       python3 ssd1306_anim_encode.py --name bootAnimation --period 40 -o bootAnimation.h frames/*.pbm
+#
+
+import argparse
+import sys
+
+WIDTH = 128
+HEIGHT = 64
+FRAME_SIZE = WIDTH * HEIGHT // 8
+
+KEYFRAME = 0x00
+DELTA = 0x01
+END_SPANS = 0xFF
+RUN = 0x80
+MAX_COUNT = 128
+
+# Unchanged columns cheaper to resend than to open a new span on the bus
+# (address window command and a new data transfer)
+MERGE_GAP = 8
+
+
+def read_pbm(path):
+    """Return the pixels of a 128x64 PBM image (P1 or P4) as rows of 0/1."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    tokens = []
+    pos = 0
+    while len(tokens) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while data[pos:pos + 1] not in (b"\n", b""):
+                pos += 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos])
+
+    magic, width, height = tokens[0], int(tokens[1]), int(tokens[2])
+    if (width, height) != (WIDTH, HEIGHT):
+        sys.exit("%s: image must be %dx%d, not %dx%d" % (path, WIDTH, HEIGHT, width, height))
+
+    if magic == b"P4":
+        raster = data[pos + 1:]
+        stride = (width + 7) // 8
+        return [[(raster[y * stride + x // 8] >> (7 - x % 8)) & 1 for x in range(width)]
+                for y in range(height)]
+    if magic == b"P1":
+        bits = [int(c) for c in data[pos:].decode("ascii") if c in "01"]
+        return [bits[y * width:(y + 1) * width] for y in range(height)]
+    sys.exit("%s: only P1 and P4 PBM images are supported" % path)
+
+
+def to_display(pixels):
+    """Pack pixels in display buffer layout: one byte per column and page, LSB on top."""
+    frame = bytearray(FRAME_SIZE)
+    for page in range(HEIGHT // 8):
+        for x in range(WIDTH):
+            value = 0
+            for bit in range(8):
+                value |= pixels[page * 8 + bit][x] << bit
+            frame[page * WIDTH + x] = value
+    return bytes(frame)
+
+
+def encode_runs(data):
+    """Pack bytes as literal and repeat runs."""
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_COUNT]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:MAX_COUNT]
+
+    while i < len(data):
+        count = 1
+        while i + count < len(data) and count < MAX_COUNT and data[i + count] == data[i]:
+            count += 1
+        if count >= 3:
+            flush()
+            out.append(RUN + count - 1)
+            out.append(data[i])
+            i += count
+        else:
+            literal.append(data[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def changed_spans(previous, frame):
+    """Return (page, first column, length) of the columns that differ, merging small gaps."""
+    spans = []
+    for page in range(HEIGHT // 8):
+        changed = [x for x in range(WIDTH)
+                   if previous[page * WIDTH + x] ^ frame[page * WIDTH + x]]
+        if not changed:
+            continue
+        start = end = changed[0]
+        for x in changed[1:]:
+            if x - end - 1 <= MERGE_GAP:
+                end = x
+            else:
+                spans.append((page, start, end - start + 1))
+                start = end = x
+        spans.append((page, start, end - start + 1))
+    return spans
+
+
+def encode_keyframe(frame):
+    return bytes([KEYFRAME]) + encode_runs(frame)
+
+
+def encode_delta(previous, frame):
+    out = bytearray([DELTA])
+    for page, column, length in changed_spans(previous, frame):
+        out.extend((page, column, length - 1))
+        out.extend(encode_runs(frame[page * WIDTH + column:page * WIDTH + column + length]))
+    out.append(END_SPANS)
+    return bytes(out)
+
+
+def decode_runs(data, pos, length):
+    out = bytearray()
+    while len(out) < length:
+        control = data[pos]
+        if control >= RUN:
+            out.extend(data[pos + 1:pos + 2] * (control - RUN + 1))
+            pos += 2
+        else:
+            out.extend(data[pos + 1:pos + 2 + control])
+            pos += control + 2
+    return out, pos
+
+
+def decode(animation):
+    """Decode an animation the way SSD1306Animation sends it, to verify the encoder."""
+    count = animation[0] | animation[1] << 8
+    pos = 4
+    screen = bytearray(FRAME_SIZE)
+    frames = []
+    for _ in range(count):
+        kind = animation[pos]
+        pos += 1
+        if kind == KEYFRAME:
+            screen[:], pos = decode_runs(animation, pos, FRAME_SIZE)
+        else:
+            while animation[pos] != END_SPANS:
+                page, column, length = animation[pos], animation[pos + 1], animation[pos + 2] + 1
+                data, pos = decode_runs(animation, pos + 3, length)
+                screen[page * WIDTH + column:page * WIDTH + column + length] = data
+            pos += 1
+        frames.append(bytes(screen))
+    return frames
+
+
+def encode(frames, period, keyframe_interval):
+    out = bytearray((len(frames) & 0xFF, len(frames) >> 8, period & 0xFF, period >> 8))
+    previous = None
+    for index, frame in enumerate(frames):
+        keyframe = encode_keyframe(frame)
+        if previous is None or (keyframe_interval and index % keyframe_interval == 0):
+            out.extend(keyframe)
+        else:
+            delta = encode_delta(previous, frame)
+            out.extend(delta if len(delta) < len(keyframe) else keyframe)
+        previous = frame
+    return bytes(out)
+
+
+def write_header(path, name, animation, frame_count, period):
+    lines = ["// Generated by ssd1306_anim_encode.py: %d frames, %d ms per frame, %d bytes"
+             % (frame_count, period, len(animation)),
+             "",
+             "#ifndef %s_H" % name.upper(),
+             "#define %s_H" % name.upper(),
+             "",
+             "static const unsigned char %s[%d] = {" % (name, len(animation))]
+    for i in range(0, len(animation), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in animation[i:i + 16]) + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    lines += ["};", "", "#endif", ""]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Encode 128x64 PBM frames for SSD1306Animation")
+    parser.add_argument("frames", nargs="+", help="PBM images, one per frame, in order")
+    parser.add_argument("-o", "--output", required=True, help="C header to create")
+    parser.add_argument("--name", default="animation", help="name of the C array")
+    parser.add_argument("--period", type=int, default=50, help="frame period in ms (default 50)")
+    parser.add_argument("--keyframe-interval", type=int, default=0,
+                        help="force a keyframe every N frames (default: only when smaller than the delta)")
+    args = parser.parse_args()
+
+    if len(args.frames) > 0xFFFF or not 0 <= args.period <= 0xFFFF:
+        sys.exit("too many frames or frame period out of range")
+
+    frames = [to_display(read_pbm(path)) for path in args.frames]
+    animation = encode(frames, args.period, args.keyframe_interval)
+    if decode(animation) != frames:
+        sys.exit("internal error: decoded frames differ from the source frames")
+
+    write_header(args.output, args.name, animation, len(frames), args.period)
+    print("%s: %d frames, %d bytes (%d bytes raw)"
+          % (args.output, len(frames), len(animation), len(frames) * FRAME_SIZE))
+
+
+if __name__ == "__main__":
+    main()
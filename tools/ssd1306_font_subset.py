@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+#
+#   Font generator for SSD1306::setFont()
+#
+#   Converts the built-in CP437 charset of src/Font.h into a Unicode font, keeping only
+#   the characters an application prints, and writes it as a C header.
+#
+#   Example:
+#       python3 ssd1306_font_subset.py --name digitsFont --chars "0123456789.:-°C" -o digitsFont.h
+#       python3 ssd1306_font_subset.py --name uiFont --text ../main.cpp -o uiFont.h
+#
+
+import argparse
+import os
+import re
+import sys
+
+DEFAULT_SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "Font.h")
+
+# CP437 graphic characters at the positions of the ASCII control codes
+CP437_LOW = "☺☻♥♦♣♠•◘○◙♂♀♪♫☼" \
+            "►◄↕‼¶§▬↨↑↓→←∟↔▲▼"
+
+
+def cp437_to_unicode(index):
+    if index == 0:
+        return None
+    if index < 0x20:
+        return ord(CP437_LOW[index - 1])
+    if index == 0x7F:
+        return 0x2302
+    return ord(bytes([index]).decode("cp437"))
+
+
+def read_charset(path):
+    """Return {code point: 8 column bytes} from the charset array of Font.h."""
+    with open(path) as f:
+        text = f.read()
+    body = text[text.index("{") + 1:text.rindex("}")]
+    data = [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", body)]
+    if len(data) != 2048:
+        sys.exit("%s: expected 2048 bytes in charset, found %d" % (path, len(data)))
+
+    glyphs = {}
+    for index in range(256):
+        codepoint = cp437_to_unicode(index)
+        if codepoint is not None:
+            glyphs[codepoint] = data[index * 8:index * 8 + 8]
+    return glyphs
+
+
+def longest_run(codepoints):
+    """Return (first index, length) of the longest run of consecutive code points."""
+    best_start, best_count = 0, 0
+    start = 0
+    for i in range(1, len(codepoints) + 1):
+        if i == len(codepoints) or codepoints[i] != codepoints[i - 1] + 1:
+            if i - start > best_count:
+                best_start, best_count = start, i - start
+            start = i
+    return best_start, best_count
+
+
+def write_header(path, name, glyphs):
+    codepoints = sorted(glyphs)
+    direct_start, direct_count = longest_run(codepoints)
+
+    lines = ["// Generated by ssd1306_font_subset.py: %d glyphs, %d bytes"
+             % (len(codepoints), len(codepoints) * 10),
+             "",
+             "#ifndef %s_H" % name.upper(),
+             "#define %s_H" % name.upper(),
+             "",
+             '#include "SSD1306.h"',
+             "",
+             "static const SSD1306Glyph %sGlyphs[%d] = {" % (name, len(codepoints))]
+    for codepoint in codepoints:
+        char = chr(codepoint)
+        comment = char if char.isprintable() and not char.isspace() and char != "\\" else "U+%04X" % codepoint
+        lines.append("    { 0x%04X, { %s } }, // %s"
+                     % (codepoint, ", ".join("0x%02X" % b for b in glyphs[codepoint]), comment))
+    lines[-1] = lines[-1].replace("}, //", "}  //", 1)
+    lines += ["};",
+              "",
+              "static const SSD1306Font %s = { %sGlyphs, %d, %d, %d };"
+              % (name, name, len(codepoints), direct_start, direct_count),
+              "",
+              "#endif",
+              ""]
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Create a Unicode font subset for SSD1306::setFont()")
+    parser.add_argument("-o", "--output", required=True, help="C header to create")
+    parser.add_argument("--name", default="font", help="name of the SSD1306Font")
+    parser.add_argument("--chars", default="", help="characters to keep")
+    parser.add_argument("--text", nargs="*", default=[], help="UTF-8 files whose characters are kept")
+    parser.add_argument("--all", action="store_true", help="keep every glyph of the charset")
+    parser.add_argument("--source", default=DEFAULT_SOURCE, help="charset to convert (default src/Font.h)")
+    args = parser.parse_args()
+
+    charset = read_charset(args.source)
+    if args.all:
+        wanted = set(charset)
+    else:
+        wanted = {ord(c) for c in args.chars}
+        for path in args.text:
+            with open(path, encoding="utf-8") as f:
+                wanted |= {ord(c) for c in f.read() if c not in "\r\n\t"}
+        wanted.add(ord("?"))  # printed for missing characters
+
+    missing = sorted(c for c in wanted if c not in charset)
+    if missing:
+        print("warning: no glyph for %s" % " ".join("U+%04X" % c for c in missing), file=sys.stderr)
+
+    glyphs = {c: charset[c] for c in wanted if c in charset}
+    if not glyphs:
+        sys.exit("no glyphs selected")
+    write_header(args.output, args.name, glyphs)
+    print("%s: %d glyphs, %d bytes (%d bytes for the full charset)"
+          % (args.output, len(glyphs), len(glyphs) * 10, len(charset) * 10))
+
+
+if __name__ == "__main__":
+    main()